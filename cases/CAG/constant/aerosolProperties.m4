@@ -38,6 +38,12 @@ fixedSectionalCoeffs
     rescale     true;
 
     initFromPatch inlet1-vapor;
+
+    kernel
+    {
+        type        batched;
+        verify      true;
+    }
 }
 
 submodels
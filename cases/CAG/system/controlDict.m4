@@ -105,4 +105,12 @@ functions
         patches         (outlet);
         writeControl    writeTime;
     }
+
+    aerosolProfile
+    {
+        type            aerosolProfile;
+        libs            ("libaerosolModels.so");
+        internalCost    true;
+        writeControl    writeTime;
+    }
 }
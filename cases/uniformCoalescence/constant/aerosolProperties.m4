@@ -36,6 +36,13 @@ fixedSectionalCoeffs
     }
 
     initFromPatch walls;
+
+    coalescenceKernel
+    {
+        type        tabulated;
+        tolerance   1E-3;
+        verify      true;
+    }
 }
 
 submodels
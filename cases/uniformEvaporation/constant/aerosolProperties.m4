@@ -36,6 +36,12 @@ fixedSectionalCoeffs
     }
 
     rescale     true;
+
+    kernel
+    {
+        type        batched;
+        verify      true;
+    }
 }
 
 submodels
@@ -0,0 +1,106 @@
+#!/usr/bin/python
+
+# Compares the sectional fields (M.* and V.*) of the written times to those of
+# a reference case, e.g., the unpacked fields of a packed run to the fields of
+# a run with separate fields. The fields are compared as text, in ASCII format:
+# words must match and numbers must agree within the given tolerance, relative
+# to the largest magnitude of the internal field.
+
+import sys
+import os
+import glob
+import re
+
+reference = sys.argv[1]
+tolerance = float(sys.argv[2])
+
+
+def tokens(fileName):
+
+    with open(fileName) as f:
+        text = f.read()
+
+    # Skip the header
+
+    text = text[text.index('dimensions'):]
+
+    return re.findall(r'[^\s();{}]+', text)
+
+
+def number(token):
+
+    try:
+        return float(token)
+    except ValueError:
+        return None
+
+
+def compare(fileName, referenceName):
+
+    t = tokens(fileName)
+    tRef = tokens(referenceName)
+
+    if len(t) != len(tRef):
+        return 'different number of entries'
+
+    # Scale of the internal field values
+
+    internal = tRef[tRef.index('internalField'):tRef.index('boundaryField')]
+
+    scale = max([abs(number(x)) for x in internal if number(x) is not None])
+
+    if scale == 0.0:
+        scale = 1.0
+
+    error = 0.0
+
+    for x, xRef in zip(t, tRef):
+
+        if number(xRef) is None:
+            if x != xRef:
+                return 'entry ' + x + ' instead of ' + xRef
+        elif number(x) is None:
+            return 'entry ' + x + ' instead of a number'
+        else:
+            error = max(error, abs(number(x) - number(xRef))/scale)
+
+    if error > tolerance:
+        return 'relative difference ' + str(error)
+
+    return None
+
+
+times = [d for d in os.listdir(reference) if re.match(r'^[0-9.eE+-]+$', d)]
+
+times = sorted([d for d in times if float(d) > 0], key=float)
+
+nFields = 0
+nFailed = 0
+
+for time in times:
+
+    referenceNames = sorted(
+        glob.glob(os.path.join(reference, time, 'M.*'))
+        + glob.glob(os.path.join(reference, time, 'V.*')))
+
+    for referenceName in referenceNames:
+
+        name = os.path.basename(referenceName)
+        fileName = os.path.join(time, name)
+
+        nFields += 1
+
+        if not os.path.isfile(fileName):
+            result = 'missing'
+        else:
+            result = compare(fileName, referenceName)
+
+        if result is not None:
+            nFailed += 1
+            print('Field ' + name + ' at time ' + time + ': ' + result)
+
+print('Compared ' + str(nFields) + ' fields, ' + str(nFailed)
+      + ' outside the tolerance of ' + str(tolerance))
+
+if nFailed > 0 or nFields == 0:
+    sys.exit(1)
@@ -38,6 +38,12 @@ fixedSectionalCoeffs
     rescale     true;
 
     initFromPatch walls;
+
+    storage
+    {
+        type        VARSTORAGE;
+        precision   VARPRECISION;
+    }
 }
 
 submodels